@@ -743,7 +743,7 @@ Call structure DSM and FDJS
       real mix(ndim), mixd(ndim)
       real fjac(vmix_dim), eps
       integer i,j,k, numgrp
-      integer ix,iy,iz,ie,jx,jy,jz,je,s
+      integer ix,iy,iz,ie,jx,jy,jz,je,s,p
       logical col
 
       eps = 1.0e-08 ! --> adjust?
@@ -807,7 +807,9 @@ Call structure DSM and FDJS
             if (jy-iy.eq. -1) s  = s + 1
             if (jy-iy.eq.  0) s  = s + 2
             if (jy-iy.eq.  1) s  = s + 3
-            an(s,ie,je,ix,iy,iz) = an(s,ie,je,ix,iy,iz) + fjac(j)
+            p = npos(s,ie,je)
+            if (p.eq.0) call stencil_error(s,ie,je)
+            an(p,ix,iy,iz) = an(p,ix,iy,iz) + fjac(j)
          enddo
       enddo
 